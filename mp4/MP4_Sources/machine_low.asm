@@ -15,4 +15,16 @@ global _get_EFLAGS
 _get_EFLAGS:
 	pushfd			; push eflags
 	pop	eax		; pop contents into eax
-	ret
\ No newline at end of file
+	ret
+
+; ----------------------------------------------------------------------
+; rdtsc()
+; 
+; Returns the 64-bit time-stamp counter in edx:eax.
+;
+; ----------------------------------------------------------------------
+global _rdtsc
+; this function is exported.
+_rdtsc:
+	rdtsc
+	ret